@@ -0,0 +1,4 @@
+/*
+ * cookie.h: host stand-in for the Lattice C header, for the TEST
+ * programs (which don't use cookies)
+ */
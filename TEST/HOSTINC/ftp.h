@@ -0,0 +1,5 @@
+/*
+ * ftp.h: lets the pftp sources include "ftp.h" on a host with a
+ * case-sensitive file system
+ */
+#include "../../FTP.H"
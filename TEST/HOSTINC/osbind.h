@@ -0,0 +1,8 @@
+/*
+ * osbind.h: host stand-in for the Lattice C header, for the TEST
+ * programs: only the GEMDOS calls they provide are declared
+ */
+#include <portab.h>
+
+LONG Fread(WORD fh,LONG count,void *buf);
+LONG Fseek(LONG offset,WORD fh,WORD mode);
@@ -0,0 +1,28 @@
+/*
+ * portab.h: host stand-in for the Lattice C header, for the TEST
+ * programs: the sizes match the Atari's (16-bit WORD, 32-bit LONG)
+ */
+#ifndef PORTAB_H
+#define PORTAB_H
+#include <stdint.h>
+
+typedef int16_t			WORD;
+typedef uint16_t		UWORD;
+typedef int32_t			LONG;
+typedef uint32_t		ULONG;
+typedef uint8_t			UBYTE;
+typedef char			BYTE;
+
+#define MLOCAL			static
+#define TRUE			1
+#define FALSE			0
+#define cdecl
+
+#ifndef min
+#define min(a,b)		((a)<(b)?(a):(b))
+#define max(a,b)		((a)>(b)?(a):(b))
+#endif
+
+typedef struct { LONG dummy; } BASPAG;
+
+#endif